@@ -0,0 +1,75 @@
+#!/usr/bin/perl -w
+
+# Symbolize the histogram printed by the xv6 kprof program.
+#
+#   make qemu | tee console.log       # run "kprof cmd ..." inside xv6
+#   perl kprof.pl [xv6-dir] < console.log
+#
+# Kernel PCs are looked up in kernel/kernel.sym, user PCs of the
+# profiled command in user/<cmd>.sym and the shared user/ulib.sym;
+# all are written by the Makefile.
+# Prints one line per function, hottest first.
+
+use strict;
+
+my $xv6 = shift || ".";
+my ($cmdpid, $cmd) = (-1, "");
+my %count;
+my $total = 0;
+
+sub loadsyms {
+    my $file = shift;
+    my @syms;
+    open(my $fh, "<", $file) or return [];
+    while (<$fh>) {
+	next unless /^([0-9a-f]+)\s+(\S+)$/;
+	push @syms, [hex($1), $2];
+    }
+    close($fh);
+    return [sort { $a->[0] <=> $b->[0] } @syms];
+}
+
+# largest symbol address <= pc
+sub lookup {
+    my ($syms, $pc) = @_;
+    my ($lo, $hi) = (0, scalar(@$syms) - 1);
+    return sprintf("0x%x", $pc) if $hi < 0 || $pc < $syms->[0][0];
+    while ($lo < $hi) {
+	my $mid = int(($lo + $hi + 1) / 2);
+	if ($syms->[$mid][0] <= $pc) { $lo = $mid; } else { $hi = $mid - 1; }
+    }
+    return $syms->[$lo][1];
+}
+
+my @samples;
+while (<STDIN>) {
+    s/\r//g;
+    if (/^kprof: exec pid (\d+) (\S+)/) {
+	($cmdpid, $cmd) = ($1, $2);
+	$cmd =~ s/^.*\///;
+	next;
+    }
+    push @samples, [$1, $2, $3, hex($4)] if /^(\d+) ([KU]) (\d+) 0x([0-9a-f]+)$/;
+}
+
+my $ksyms = loadsyms("$xv6/kernel/kernel.sym");
+my $usyms = [sort { $a->[0] <=> $b->[0] }
+	     (@{loadsyms("$xv6/user/$cmd.sym")}, @{loadsyms("$xv6/user/ulib.sym")})];
+
+foreach my $s (@samples) {
+    my ($n, $mode, $pid, $pc) = @$s;
+    my $name;
+    if ($mode eq "K") {
+	$name = "kernel:" . lookup($ksyms, $pc);
+    } elsif ($pid == $cmdpid) {
+	$name = "$cmd:" . lookup($usyms, $pc);
+    } else {
+	$name = sprintf("pid%d:0x%x", $pid, $pc);
+    }
+    $count{$name} += $n;
+    $total += $n;
+}
+
+foreach my $name (sort { $count{$b} <=> $count{$a} } keys %count) {
+    printf("%6d %5.1f%%  %s\n", $count{$name}, 100.0 * $count{$name} / $total, $name);
+}
@@ -0,0 +1,273 @@
+// Microbenchmarks for kernel fast paths.  bench without arguments
+// runs them all and bench <name> runs <name>.  Each prints the mean
+// time per operation, measured with nsecs().
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "kernel/fcntl.h"
+#include "kernel/riscv.h"
+#include "user/user.h"
+
+static void
+report(char *name, uint64 t0, uint64 t1, int n)
+{
+  printf("bench: %s: %ld ns/op (%d ops)\n", name, (t1 - t0) / n, n);
+}
+
+// pass one byte back and forth between two processes over a pair
+// of pipes; each round trip is two context switches between user
+// address spaces.
+void
+pingpong(char *s)
+{
+  int n = 2000, p1[2], p2[2], pid;
+  char c = 0;
+  uint64 t0, t1;
+
+  if(pipe(p1) < 0 || pipe(p2) < 0){
+    printf("%s: pipe failed\n", s);
+    exit(1);
+  }
+  pid = fork();
+  if(pid < 0){
+    printf("%s: fork failed\n", s);
+    exit(1);
+  }
+  if(pid == 0){
+    for(int i = 0; i < n; i++){
+      if(read(p1[0], &c, 1) != 1)
+        exit(1);
+      write(p2[1], &c, 1);
+    }
+    exit(0);
+  }
+  t0 = nsecs();
+  for(int i = 0; i < n; i++){
+    write(p1[1], &c, 1);
+    if(read(p2[0], &c, 1) != 1){
+      printf("%s: read failed\n", s);
+      exit(1);
+    }
+  }
+  t1 = nsecs();
+  wait(0);
+  // two switches per round trip
+  report(s, t0, t1, 2*n);
+}
+
+// fork a child that exits at once, and wait for it: allocproc,
+// the page-table copy and the teardown, with no exec.
+void
+forkexit(char *s)
+{
+  int n = 500;
+  uint64 t0, t1;
+
+  t0 = nsecs();
+  for(int i = 0; i < n; i++){
+    int pid = fork();
+    if(pid < 0){
+      printf("%s: fork failed\n", s);
+      exit(1);
+    }
+    if(pid == 0)
+      exit(0);
+    wait(0);
+  }
+  t1 = nsecs();
+  report(s, t0, t1, n);
+}
+
+// time from a child's exit() to its parent's wait() returning,
+// for growing heap sizes; with teardown deferred to a background
+// reclaimer this should not depend on the heap size.
+void
+exitbig(char *s)
+{
+  int mb[] = { 1, 16, 64 };
+
+  for(int k = 0; k < sizeof(mb)/sizeof(mb[0]); k++){
+    int fds[2], pid;
+    uint64 t0, t1;
+
+    if(pipe(fds) < 0){
+      printf("%s: pipe failed\n", s);
+      exit(1);
+    }
+    pid = fork();
+    if(pid < 0){
+      printf("%s: fork failed\n", s);
+      exit(1);
+    }
+    if(pid == 0){
+      char *p = sbrk(mb[k] << 20);
+      if(p == SBRK_ERROR)
+        exit(1);
+      for(int i = 0; i < (mb[k] << 20); i += PGSIZE)
+        p[i] = 1;
+      t0 = nsecs();
+      write(fds[1], &t0, sizeof(t0));
+      exit(0);
+    }
+    close(fds[1]);
+    if(read(fds[0], &t0, sizeof(t0)) != sizeof(t0)){
+      printf("%s: %d MB child failed\n", s, mb[k]);
+      exit(1);
+    }
+    wait(0);
+    t1 = nsecs();
+    close(fds[0]);
+    printf("bench: %s: %d MB heap: %ld ns exit-to-wait\n", s, mb[k], t1 - t0);
+  }
+}
+
+// fork a child that execs a trivial program, and wait for it.
+void
+forkexec(char *s)
+{
+  int n = 100;
+  char *argv[] = { "echo", 0 };
+  uint64 t0, t1;
+
+  t0 = nsecs();
+  for(int i = 0; i < n; i++){
+    int pid = fork();
+    if(pid < 0){
+      printf("%s: fork failed\n", s);
+      exit(1);
+    }
+    if(pid == 0){
+      close(1);
+      exec("echo", argv);
+      exit(1);
+    }
+    wait(0);
+  }
+  t1 = nsecs();
+  report(s, t0, t1, n);
+}
+
+// null system call: the trap in and out, plus whatever kernel
+// TLB misses the round trip takes.
+void
+syscall(char *s)
+{
+  int n = 20000;
+  uint64 t0, t1;
+
+  t0 = nsecs();
+  for(int i = 0; i < n; i++)
+    getpid();
+  t1 = nsecs();
+  report(s, t0, t1, n);
+}
+
+// fstat touches the file table, the inode and copyout, spreading
+// kernel accesses over more pages than getpid.
+void
+fstatbench(char *s)
+{
+  int n = 20000, fd;
+  struct stat st;
+  uint64 t0, t1;
+
+  if((fd = open("README", O_RDONLY)) < 0){
+    printf("%s: cannot open README\n", s);
+    exit(1);
+  }
+  t0 = nsecs();
+  for(int i = 0; i < n; i++)
+    fstat(fd, &st);
+  t1 = nsecs();
+  close(fd);
+  report(s, t0, t1, n);
+}
+
+// copy a page into a pipe and back out: one copyin and one
+// copyout of PGSIZE bytes per op.
+void
+copy(char *s)
+{
+  int n = 5000, fds[2];
+  char *p = sbrk(PGSIZE);
+  uint64 t0, t1;
+
+  if(p == SBRK_ERROR || pipe(fds) < 0){
+    printf("%s: setup failed\n", s);
+    exit(1);
+  }
+  memset(p, 1, PGSIZE);
+  t0 = nsecs();
+  for(int i = 0; i < n; i++){
+    // a pipe holds 512 bytes, so move the page in pieces.
+    for(int off = 0; off < PGSIZE; off += 512){
+      write(fds[1], p + off, 512);
+      read(fds[0], p + off, 512);
+    }
+  }
+  t1 = nsecs();
+  close(fds[0]);
+  close(fds[1]);
+  report(s, t0, t1, n);
+}
+
+// eager sbrk of 64 MiB and back, with how many times the kmem
+// lock was taken while growing.
+struct lockstat locks[512];
+
+void
+sbrk64(char *s)
+{
+  int sz = 64 << 20, n;
+  uint64 t0, t1, acq = 0;
+  char *p;
+
+  lockstat(LOCKSTAT_RESET, 0, 0);
+  t0 = nsecs();
+  p = sbrk(sz);
+  t1 = nsecs();
+  if(p == SBRK_ERROR){
+    printf("%s: sbrk failed\n", s);
+    exit(1);
+  }
+  n = lockstat(LOCKSTAT_READ, locks, sizeof(locks)/sizeof(locks[0]));
+  for(int i = 0; i < n; i++)
+    if(strcmp(locks[i].name, "kmem") == 0)
+      acq += locks[i].acquires;
+  sbrk(-sz);
+  printf("bench: %s: %ld ns/page, %ld kmem acquires for %d pages\n", s,
+         (t1 - t0) / (sz / PGSIZE), acq, sz / PGSIZE);
+}
+
+struct bench {
+  void (*f)(char *);
+  char *s;
+} benches[] = {
+  {pingpong, "pingpong"},
+  {forkexit, "forkexit"},
+  {forkexec, "forkexec"},
+  {exitbig, "exitbig"},
+  {syscall, "syscall"},
+  {fstatbench, "fstat"},
+  {copy, "copy"},
+  {sbrk64, "sbrk64"},
+  { 0, 0},
+};
+
+int
+main(int argc, char *argv[])
+{
+  int n = 0;
+
+  for(struct bench *b = benches; b->s != 0; b++){
+    if(argc < 2 || strcmp(argv[1], b->s) == 0){
+      b->f(b->s);
+      n++;
+    }
+  }
+  if(n == 0){
+    fprintf(2, "usage: bench [name]\n");
+    exit(1);
+  }
+  exit(0);
+}
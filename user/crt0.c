@@ -0,0 +1,15 @@
+#include "kernel/types.h"
+#include "user/user.h"
+
+//
+// wrapper so that it's OK if main() does not call exit().
+// Linked into each program rather than ULIB, since _ulib
+// is linked before any main() exists.
+//
+void
+start()
+{
+  extern int main();
+  main();
+  exit(0);
+}
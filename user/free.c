@@ -0,0 +1,24 @@
+// Print free physical memory, in total and by buddy order.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "user/user.h"
+
+#define NORDER 32
+
+int
+main(void)
+{
+  uint64 nfree[NORDER];
+  int n;
+
+  printf("free: %d pages\n", freepages());
+  if((n = freeorders(nfree, NORDER)) < 0){
+    fprintf(2, "free: freeorders failed\n");
+    exit(1);
+  }
+  for(int k = 0; k < n; k++)
+    if(nfree[k])
+      printf("  order %d (%ld pages): %ld free\n", k, 1L << k, nfree[k]);
+  exit(0);
+}
@@ -0,0 +1,106 @@
+// Sample the interrupted PC on every timer interrupt while a
+// command runs, then print a histogram of the hottest PCs:
+//
+//   kprof cmd [args...]
+//
+// Each histogram line is "count mode pid pc", mode being K or U.
+// kprof.pl on the host maps the PCs to kernel.sym and _cmd.sym.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "user/user.h"
+
+#define NBUF   256     // samples per kprof(KPROF_READ)
+#define NHASH  4096    // distinct (mode, pid, pc) buckets
+#define NTOP   40      // histogram lines printed
+
+struct bucket {
+  uint64 pc;
+  int pid;
+  int user;
+  int count;
+};
+
+struct kprofsample samples[NBUF];
+struct bucket hist[NHASH];
+int nbucket;
+int nlost;
+
+void
+add(struct kprofsample *s)
+{
+  uint h = (s->pc >> 1) ^ (s->pid * 31) ^ s->user;
+
+  for(int i = 0; i < NHASH; i++){
+    struct bucket *b = &hist[(h + i) % NHASH];
+    if(b->count == 0){
+      b->pc = s->pc;
+      b->pid = s->pid;
+      b->user = s->user;
+      b->count = 1;
+      nbucket++;
+      return;
+    }
+    if(b->pc == s->pc && b->pid == s->pid && b->user == s->user){
+      b->count++;
+      return;
+    }
+  }
+  nlost++;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pid, n, total, dropped;
+
+  if(argc < 2){
+    fprintf(2, "usage: kprof cmd [args...]\n");
+    exit(1);
+  }
+
+  if(kprof(KPROF_START, 0, 0) < 0){
+    fprintf(2, "kprof: cannot start sampling\n");
+    exit(1);
+  }
+  pid = fork();
+  if(pid < 0){
+    fprintf(2, "kprof: fork failed\n");
+    exit(1);
+  }
+  if(pid == 0){
+    exec(argv[1], argv+1);
+    fprintf(2, "kprof: exec %s failed\n", argv[1]);
+    exit(1);
+  }
+  wait(0);
+  dropped = kprof(KPROF_STOP, 0, 0);
+
+  total = 0;
+  while((n = kprof(KPROF_READ, samples, NBUF)) > 0){
+    for(int i = 0; i < n; i++)
+      add(&samples[i]);
+    total += n;
+  }
+
+  printf("kprof: exec pid %d %s\n", pid, argv[1]);
+  printf("kprof: %d samples, %d dropped, %d pcs\n", total, dropped, nbucket);
+  if(nlost)
+    printf("kprof: %d samples not counted, histogram full\n", nlost);
+
+  // selection sort the top NTOP buckets to the front.
+  for(int i = 0; i < NTOP && i < NHASH; i++){
+    int max = i;
+    for(int j = i+1; j < NHASH; j++)
+      if(hist[j].count > hist[max].count)
+        max = j;
+    if(hist[max].count == 0)
+      break;
+    struct bucket t = hist[i];
+    hist[i] = hist[max];
+    hist[max] = t;
+    printf("%d %c %d 0x%lx\n", hist[i].count, hist[i].user ? 'U' : 'K',
+           hist[i].pid, hist[i].pc);
+  }
+  exit(0);
+}
@@ -0,0 +1,122 @@
+// Lock microbenchmark: nproc processes hammer the kernel's hot
+// locks at once and report ns per operation and the contention
+// lockstat saw.
+//
+//   lockbench [nproc [iters]]
+//
+//   kalloc  sbrk a page, touch it, give it back   (kmem)
+//   bcache  open, read and close README           (bcache, itable, log)
+//   proc    fork a child that exits, wait for it  (proc, wait_lock)
+//
+// bench_lock.exp runs it at CPUS=1..8 to compare lock implementations.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "kernel/fcntl.h"
+#include "kernel/riscv.h"
+#include "user/user.h"
+
+#define NLOCKS 512
+
+struct lockstat locks[NLOCKS];
+char buf[512];
+
+void
+op_kalloc(void)
+{
+  char *p = sbrk(PGSIZE);
+  if(p == SBRK_ERROR){
+    fprintf(2, "lockbench: sbrk failed\n");
+    exit(1);
+  }
+  p[0] = 1;
+  sbrk(-PGSIZE);
+}
+
+void
+op_bcache(void)
+{
+  int fd = open("README", O_RDONLY);
+  if(fd < 0){
+    fprintf(2, "lockbench: cannot open README\n");
+    exit(1);
+  }
+  read(fd, buf, sizeof(buf));
+  close(fd);
+}
+
+void
+op_proc(void)
+{
+  int pid = fork();
+  if(pid < 0){
+    fprintf(2, "lockbench: fork failed\n");
+    exit(1);
+  }
+  if(pid == 0)
+    exit(0);
+  wait(0);
+}
+
+void
+report(void)
+{
+  uint64 acq = 0, cont = 0, spins = 0;
+  int n = lockstat(LOCKSTAT_READ, locks, NLOCKS);
+
+  for(int i = 0; i < n; i++){
+    acq += locks[i].acquires;
+    cont += locks[i].contended;
+    spins += locks[i].spins;
+  }
+  printf("  acquires %ld contended %ld spin-cycles %ld\n", acq, cont, spins);
+}
+
+void
+bench(char *name, void (*op)(void), int nproc, int iters)
+{
+  uint64 t0, t1;
+
+  lockstat(LOCKSTAT_RESET, 0, 0);
+  t0 = nsecs();
+  for(int i = 0; i < nproc; i++){
+    int pid = fork();
+    if(pid < 0){
+      fprintf(2, "lockbench: fork failed\n");
+      exit(1);
+    }
+    if(pid == 0){
+      for(int j = 0; j < iters; j++)
+        op();
+      exit(0);
+    }
+  }
+  for(int i = 0; i < nproc; i++)
+    wait(0);
+  t1 = nsecs();
+
+  printf("lockbench: %s nproc %d: %ld ns/op\n", name, nproc,
+         (t1 - t0) / ((uint64)nproc * iters));
+  report();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nproc = 4, iters = 1000;
+
+  if(argc > 1)
+    nproc = atoi(argv[1]);
+  if(argc > 2)
+    iters = atoi(argv[2]);
+  if(nproc < 1 || iters < 1){
+    fprintf(2, "usage: lockbench [nproc [iters]]\n");
+    exit(1);
+  }
+
+  bench("kalloc", op_kalloc, nproc, iters);
+  bench("bcache", op_bcache, nproc, iters);
+  bench("proc", op_proc, nproc, iters / 10 + 1);
+  printf("lockbench: done\n");
+  exit(0);
+}
@@ -0,0 +1,85 @@
+// Report spinlock contention while a command runs:
+//
+//   lockstat [cmd [args...]]
+//
+// Without a command, reports the counts accumulated since boot.
+// Locks that share a name (e.g. every proc's lock) are summed, and
+// the names are ranked by cycles spent spinning. For sleeplocks,
+// contended acquires that did not sleep were won by spinning on a
+// holder running on another hart.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "user/user.h"
+
+#define NLOCKS 512
+#define NTOP   20
+
+struct lockstat locks[NLOCKS];
+struct lockstat byname[NLOCKS];
+int nname;
+
+void
+sum(struct lockstat *l)
+{
+  int i;
+
+  for(i = 0; i < nname; i++)
+    if(strcmp(byname[i].name, l->name) == 0)
+      break;
+  if(i == nname){
+    memmove(byname[i].name, l->name, sizeof(l->name));
+    nname++;
+  }
+  byname[i].acquires += l->acquires;
+  byname[i].contended += l->contended;
+  byname[i].spins += l->spins;
+  byname[i].sleeps += l->sleeps;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, pid;
+
+  if(argc > 1){
+    lockstat(LOCKSTAT_RESET, 0, 0);
+    pid = fork();
+    if(pid < 0){
+      fprintf(2, "lockstat: fork failed\n");
+      exit(1);
+    }
+    if(pid == 0){
+      exec(argv[1], argv+1);
+      fprintf(2, "lockstat: exec %s failed\n", argv[1]);
+      exit(1);
+    }
+    wait(0);
+  }
+
+  if((n = lockstat(LOCKSTAT_READ, locks, NLOCKS)) < 0){
+    fprintf(2, "lockstat: cannot read lock statistics\n");
+    exit(1);
+  }
+  // skip locks that were never taken, so they can't crowd out
+  // used ones with no spins from the ranking below.
+  for(int i = 0; i < n; i++){
+    locks[i].name[sizeof(locks[i].name)-1] = 0;
+    if(locks[i].acquires)
+      sum(&locks[i]);
+  }
+
+  printf("name acquires contended spin-cycles sleeps\n");
+  for(int i = 0; i < NTOP && i < nname; i++){
+    int max = i;
+    for(int j = i+1; j < nname; j++)
+      if(byname[j].spins > byname[max].spins)
+        max = j;
+    struct lockstat t = byname[i];
+    byname[i] = byname[max];
+    byname[max] = t;
+    printf("%s %ld %ld %ld %ld\n", byname[i].name, byname[i].acquires,
+           byname[i].contended, byname[i].spins, byname[i].sleeps);
+  }
+  exit(0);
+}
@@ -3,13 +3,6 @@
 #include "user/user.h"
 #include "kernel/riscv.h"
 
-#ifndef PROT_NONE
-#define PROT_NONE  0x0
-#define PROT_READ  0x1
-#define PROT_WRITE 0x2
-#define PROT_EXEC  0x4
-#endif
-
 // ---------- Common printing helpers ----------
 static void die(const char *msg){ printf("%s\n", msg); exit(1); }
 static void passfail(const char *label, int pass){
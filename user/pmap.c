@@ -0,0 +1,102 @@
+// Print this process's address space as ranges of pages with the
+// same mapping state, using one pagemap() call per 512 pages:
+//
+//   pmap [-f]
+//
+// Each line is "start-end npages flags", flags as in cow_test
+// ("VRWXU" plus C for COW) or "unmapped". -f forks first and maps
+// the child, whose heap is then COW-shared with pmap.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "kernel/riscv.h"
+#include "user/user.h"
+
+#define NENT 512
+
+struct pagemapent ents[NENT];
+
+static void
+fmt_flags(uint64 f, char *out)
+{
+  int k = 0;
+
+  if((f & PTE_V) == 0){
+    strcpy(out, "unmapped");
+    return;
+  }
+  out[k++] = 'V';
+  out[k++] = (f & PTE_R) ? 'R' : '-';
+  out[k++] = (f & PTE_W) ? 'W' : '-';
+  out[k++] = (f & PTE_X) ? 'X' : '-';
+  out[k++] = (f & PTE_U) ? 'U' : '-';
+  out[k++] = (f & PTE_COW) ? 'C' : '-';
+  out[k] = 0;
+}
+
+static void
+range(uint64 start, uint64 end, uint64 flags, int level)
+{
+  char buf[12];
+
+  fmt_flags(flags, buf);
+  printf("%p-%p %ld %s", (void *) start, (void *) end, (end - start) / PGSIZE, buf);
+  if(level > 0)
+    printf(" L%d", level);
+  printf("\n");
+}
+
+// print [va, end) as runs of pages with equal flags and level.
+static void
+pmap(uint64 va, uint64 end)
+{
+  uint64 start = va, flags = 0;
+  int level = 0, first = 1;
+
+  while(va < end){
+    int n = (end - va) / PGSIZE;
+    if(n > NENT)
+      n = NENT;
+    if(pagemap((void *) va, n, ents) < 0){
+      fprintf(2, "pmap: pagemap %p failed\n", (void *) va);
+      exit(1);
+    }
+    for(int i = 0; i < n; i++, va += PGSIZE){
+      uint64 f = ents[i].flags & (PTE_V|PTE_R|PTE_W|PTE_X|PTE_U|PTE_COW);
+      if(first){
+        flags = f;
+        level = ents[i].level;
+        first = 0;
+      } else if(f != flags || ents[i].level != level){
+        range(start, va, flags, level);
+        start = va;
+        flags = f;
+        level = ents[i].level;
+      }
+    }
+  }
+  if(!first)
+    range(start, va, flags, level);
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc > 1 && strcmp(argv[1], "-f") == 0){
+    int pid = fork();
+    if(pid < 0){
+      fprintf(2, "pmap: fork failed\n");
+      exit(1);
+    }
+    if(pid > 0){
+      wait(0);
+      exit(0);
+    }
+  }
+
+  printf("text, data, stack, heap:\n");
+  pmap(0, PGROUNDUP((uint64) sbrk(0)));
+  printf("usyspage:\n");
+  pmap(USYSPAGE, USYSPAGE + PGSIZE);
+  exit(0);
+}
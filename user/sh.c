@@ -142,6 +142,56 @@ getcmd(char *buf, int nbuf)
   return 0;
 }
 
+// ulimit [-r|-v|-R|-V pages|unlimited]
+// With no option, print the limits; otherwise set one.
+void
+ulimit(char *args)
+{
+  static char *opts = "rvRV";
+  static char *names[] = { "rss", "as", "tree rss", "tree as" };
+  char *flag, *val;
+  uint64 lim;
+  int r;
+
+  flag = args;
+  while(*flag == ' ')
+    flag++;
+  if(*flag == 0){
+    for(r = 0; r < RLIM_NLIMITS; r++){
+      if(getrlimit(r, &lim) < 0)
+        continue;
+      if(lim == RLIM_INFINITY)
+        printf("-%c %s (pages): unlimited\n", opts[r], names[r]);
+      else
+        printf("-%c %s (pages): %ld\n", opts[r], names[r], lim);
+    }
+    return;
+  }
+
+  if(flag[0] != '-' || flag[1] == 0 || strchr(opts, flag[1]) == 0)
+    goto usage;
+  r = strchr(opts, flag[1]) - opts;
+  val = flag + 2;
+  while(*val == ' ')
+    val++;
+  if(*val == 0)
+    goto usage;
+  if(strcmp(val, "unlimited") == 0){
+    lim = RLIM_INFINITY;
+  } else {
+    for(char *p = val; *p; p++)
+      if(*p < '0' || *p > '9')
+        goto usage;
+    lim = atoi(val);
+  }
+  if(setrlimit(r, lim) < 0)
+    fprintf(2, "ulimit: cannot set %s to %s\n", names[r], val);
+  return;
+
+usage:
+  fprintf(2, "usage: ulimit [-r|-v|-R|-V pages|unlimited]\n");
+}
+
 int
 main(void)
 {
@@ -168,6 +218,12 @@ main(void)
       cmd[strlen(cmd)-1] = 0;  // chop \n
       if(chdir(cmd+3) < 0)
         fprintf(2, "cannot cd %s\n", cmd+3);
+    } else if(strlen(cmd) >= 7 && memcmp(cmd, "ulimit", 6) == 0 &&
+              (cmd[6] == ' ' || cmd[6] == '\n')){
+      // Like cd, ulimit must run in the shell itself, not in a
+      // child, so that later commands inherit the limits.
+      cmd[strlen(cmd)-1] = 0;  // chop \n
+      ulimit(cmd+6);
     } else {
       if(fork1() == 0)
         runcmd(parsecmd(cmd));
@@ -0,0 +1,101 @@
+// Trace the system calls a command makes:
+//
+//   strace [-e name,...] [-o file] cmd [args...]
+//
+// trace(mask) marks the command, and every process it forks, so
+// that the kernel records calls whose (1 << SYS_*) bit is in mask
+// into a per-process buffer. When a traced process exits, its unread
+// records pass to its parent if the parent is traced too; otherwise
+// the zombie keeps them until it is reaped. So the command's buffer
+// collects its whole process tree, and strace drains it with
+// straceread() before wait()ing, printing one line per call to the
+// console or to file.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "kernel/fcntl.h"
+#include "user/user.h"
+
+#define NBUF 64
+
+struct straced recs[NBUF];
+
+// parse a comma-separated list of syscall names into a mask.
+uint64
+parsemask(char *s)
+{
+  uint64 mask = 0;
+  char *e;
+
+  while(*s){
+    if((e = strchr(s, ',')) != 0)
+      *e = 0;
+    int i;
+    for(i = 0; i < nsysnames && i < 64; i++)
+      if(sysnames[i] && strcmp(sysnames[i], s) == 0)
+        break;
+    if(i == nsysnames || i == 64){
+      fprintf(2, "strace: unknown syscall %s\n", s);
+      exit(1);
+    }
+    mask |= 1L << i;
+    if(e == 0)
+      break;
+    s = e + 1;
+  }
+  return mask;
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint64 mask = ~0L;
+  int fd = 2, i, n, pid;
+
+  for(i = 1; i+1 < argc && argv[i][0] == '-'; i += 2){
+    if(strcmp(argv[i], "-e") == 0){
+      mask = parsemask(argv[i+1]);
+    } else if(strcmp(argv[i], "-o") == 0){
+      if((fd = open(argv[i+1], O_CREATE|O_WRONLY|O_TRUNC)) < 0){
+        fprintf(2, "strace: cannot create %s\n", argv[i+1]);
+        exit(1);
+      }
+    } else {
+      break;
+    }
+  }
+  if(i >= argc){
+    fprintf(2, "usage: strace [-e name,...] [-o file] cmd [args...]\n");
+    exit(1);
+  }
+
+  pid = fork();
+  if(pid < 0){
+    fprintf(2, "strace: fork failed\n");
+    exit(1);
+  }
+  if(pid == 0){
+    trace(mask);
+    exec(argv[i], argv+i);
+    fprintf(2, "strace: exec %s failed\n", argv[i]);
+    exit(1);
+  }
+
+  // straceread returns 0 while the command runs with nothing new,
+  // and -1 once it has exited and its buffer is empty. Don't reap
+  // it before then, or the tail of the trace is lost.
+  while((n = straceread(pid, recs, NBUF)) >= 0){
+    if(n == 0){
+      pause(1);
+      continue;
+    }
+    for(int j = 0; j < n; j++){
+      struct straced *r = &recs[j];
+      char *name = (r->num >= 0 && r->num < nsysnames && sysnames[r->num]) ? sysnames[r->num] : "?";
+      fprintf(fd, "%d: %s(0x%lx, 0x%lx, 0x%lx) = %ld <%ld ns>\n", r->pid, name,
+              r->arg[0], r->arg[1], r->arg[2], r->ret, r->ns);
+    }
+  }
+  wait(0);
+  exit(0);
+}
@@ -0,0 +1,63 @@
+// Report how often each system call was made and how long it
+// spent in the kernel:
+//
+//   sysstat [-h] [cmd [args...]]
+//
+// With a command, counts are reset first and cover the whole
+// system while the command runs; without one, they cover
+// everything since boot. -h also prints each call's log2
+// latency histogram.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "user/user.h"
+
+#define NSYS 64
+
+struct sysstat stats[NSYS];
+
+int
+main(int argc, char *argv[])
+{
+  int n, pid, hist = 0, first = 1;
+
+  if(argc > 1 && strcmp(argv[1], "-h") == 0){
+    hist = 1;
+    first = 2;
+  }
+
+  if(argc > first){
+    sysstat(SYSSTAT_RESET, 0, 0);
+    pid = fork();
+    if(pid < 0){
+      fprintf(2, "sysstat: fork failed\n");
+      exit(1);
+    }
+    if(pid == 0){
+      exec(argv[first], argv+first);
+      fprintf(2, "sysstat: exec %s failed\n", argv[first]);
+      exit(1);
+    }
+    wait(0);
+  }
+
+  if((n = sysstat(SYSSTAT_READ, stats, NSYS)) < 0){
+    fprintf(2, "sysstat: cannot read syscall statistics\n");
+    exit(1);
+  }
+
+  printf("syscall count total-us avg-ns\n");
+  for(int i = 0; i < n; i++){
+    struct sysstat *st = &stats[i];
+    if(st->count == 0)
+      continue;
+    printf("%s %ld %ld %ld\n", (i < nsysnames && sysnames[i]) ? sysnames[i] : "?", st->count,
+           st->ns / 1000, st->ns / st->count);
+    if(!hist)
+      continue;
+    for(int b = 0; b < NSYSHIST; b++)
+      if(st->hist[b])
+        printf("  >=%ld ns: %ld\n", 1L << b, st->hist[b]);
+  }
+  exit(0);
+}
@@ -0,0 +1,38 @@
+// Run a command and print how long it took.
+//
+//   time cmd [args...]
+//
+// e.g. "time usertests concreate".
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "user/user.h"
+
+int
+main(int argc, char *argv[])
+{
+  int pid, xstatus;
+  uint64 t0, t1;
+
+  if(argc < 2){
+    fprintf(2, "usage: time cmd [args...]\n");
+    exit(1);
+  }
+
+  t0 = nsecs();
+  pid = fork();
+  if(pid < 0){
+    fprintf(2, "time: fork failed\n");
+    exit(1);
+  }
+  if(pid == 0){
+    exec(argv[1], argv+1);
+    fprintf(2, "time: exec %s failed\n", argv[1]);
+    exit(1);
+  }
+  wait(&xstatus);
+  t1 = nsecs();
+
+  fprintf(2, "time: %s: %ld us\n", argv[1], (t1 - t0) / 1000);
+  exit(xstatus);
+}
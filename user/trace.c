@@ -0,0 +1,181 @@
+// Record kernel trace events while a command runs:
+//
+//   trace [-e classes] [-o file] cmd [args...]
+//
+// classes is any of s (syscalls), f (page faults), c (context
+// switches), b (block I/O), l (log commits); default all.  Records
+// are written to file (default trace.out) as raw struct tracerec,
+// by a child that drains the kernel's rings while cmd runs, so
+// that they don't overflow.  Records dropped anyway are counted.
+//
+//   trace -p [file]
+//
+// prints a saved file as text, one record per line, for capture
+// from the console.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "kernel/fcntl.h"
+#include "user/user.h"
+
+#define NBUF 128
+
+struct tracerec recs[NBUF];
+
+char *names[] = {
+[TE_SYSENTER]  "sysenter",
+[TE_SYSEXIT]   "sysexit",
+[TE_FAULTLAZY] "faultlazy",
+[TE_FAULTCOW]  "faultcow",
+[TE_FAULTPROT] "faultprot",
+[TE_SWITCH]    "switch",
+[TE_BIOSUBMIT] "biosubmit",
+[TE_BIODONE]   "biodone",
+[TE_LOGCOMMIT] "logcommit",
+};
+
+uint
+parsemask(char *s)
+{
+  uint mask = 0;
+
+  for(; *s; s++){
+    switch(*s){
+    case 's': mask |= TR_SYSCALL; break;
+    case 'f': mask |= TR_FAULT; break;
+    case 'c': mask |= TR_SWITCH; break;
+    case 'b': mask |= TR_BIO; break;
+    case 'l': mask |= TR_LOG; break;
+    default:
+      fprintf(2, "trace: unknown event class %c\n", *s);
+      exit(1);
+    }
+  }
+  return mask;
+}
+
+void
+print(char *file)
+{
+  int fd, n;
+  char *name;
+
+  if((fd = open(file, O_RDONLY)) < 0){
+    fprintf(2, "trace: cannot open %s\n", file);
+    exit(1);
+  }
+  while((n = read(fd, recs, sizeof(recs))) > 0){
+    for(int i = 0; i < n / sizeof(recs[0]); i++){
+      struct tracerec *r = &recs[i];
+      if(r->type < sizeof(names)/sizeof(names[0]) && names[r->type])
+        name = names[r->type];
+      else
+        name = "?";
+      printf("%ld %d %d %s 0x%lx 0x%lx\n", r->time, r->cpu, r->pid, name, r->a0, r->a1);
+    }
+  }
+  close(fd);
+}
+
+// copy records into fd until tracing stops and the rings are
+// empty, leaving out this process's own events, and exit with
+// the number of records written, or -1 if a write failed.
+void
+drain(int fd, char *out)
+{
+  int me = getpid(), n, k, total = 0;
+
+  while((n = ktraceread(recs, NBUF)) >= 0){
+    if(n == 0){
+      pause(1);
+      continue;
+    }
+    if(total < 0)
+      continue;   // keep draining so the rings don't fill
+    k = 0;
+    for(int i = 0; i < n; i++)
+      if(recs[i].pid != me)
+        recs[k++] = recs[i];
+    if(write(fd, recs, k * sizeof(recs[0])) != k * sizeof(recs[0])){
+      fprintf(2, "trace: write %s failed\n", out);
+      total = -1;
+    } else {
+      total += k;
+    }
+  }
+  exit(total);
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint mask = TR_SYSCALL | TR_FAULT | TR_SWITCH | TR_BIO | TR_LOG;
+  char *out = "trace.out";
+  int i, fd, pid, drainer, w, xstatus, total, dropped;
+
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+    if(strcmp(argv[i], "-p") == 0){
+      print(i+1 < argc ? argv[i+1] : out);
+      exit(0);
+    } else if(strcmp(argv[i], "-e") == 0 && i+1 < argc){
+      mask = parsemask(argv[++i]);
+    } else if(strcmp(argv[i], "-o") == 0 && i+1 < argc){
+      out = argv[++i];
+    } else {
+      break;
+    }
+  }
+  if(i >= argc){
+    fprintf(2, "usage: trace [-e sfcbl] [-o file] cmd [args...]\n");
+    fprintf(2, "       trace -p [file]\n");
+    exit(1);
+  }
+
+  if((fd = open(out, O_CREATE|O_WRONLY|O_TRUNC)) < 0){
+    fprintf(2, "trace: cannot create %s\n", out);
+    exit(1);
+  }
+
+  // throw away anything left over from an earlier run.
+  while(ktraceread(recs, NBUF) > 0)
+    ;
+
+  ktrace(mask);
+  pid = fork();
+  if(pid < 0){
+    ktrace(0);
+    fprintf(2, "trace: fork failed\n");
+    exit(1);
+  }
+  if(pid == 0){
+    exec(argv[i], argv+i);
+    fprintf(2, "trace: exec %s failed\n", argv[i]);
+    exit(1);
+  }
+
+  drainer = fork();
+  if(drainer < 0){
+    fprintf(2, "trace: fork failed\n");
+    kill(pid);
+    wait(0);
+    ktrace(0);
+    exit(1);
+  }
+  if(drainer == 0)
+    drain(fd, out);
+
+  // stop tracing once cmd exits; the drainer then empties the
+  // rings and exits with its count.
+  total = dropped = 0;
+  while((w = wait(&xstatus)) >= 0){
+    if(w == pid)
+      dropped = ktrace(0);
+    else if(w == drainer)
+      total = xstatus;
+  }
+  close(fd);
+  if(total < 0)
+    exit(1);
+  printf("trace: %d records in %s, %d dropped\n", total, out, dropped);
+  exit(0);
+}
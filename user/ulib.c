@@ -5,17 +5,6 @@
 #include "kernel/vm.h"
 #include "user/user.h"
 
-//
-// wrapper so that it's OK if main() does not call exit().
-//
-void
-start()
-{
-  extern int main();
-  main();
-  exit(0);
-}
-
 char*
 strcpy(char *s, const char *t)
 {
@@ -148,13 +137,77 @@ memcpy(void *dst, const void *src, uint n)
   return memmove(dst, src, n);
 }
 
+// with a shared ulib image at ULIBBASE, the heap must stay below it.
+static int
+pastulib(int n)
+{
+#ifdef ULIBBASE
+  return n > 0 && (uint64)sys_sbrk(0, SBRK_EAGER) + n > ULIBBASE;
+#else
+  return 0;
+#endif
+}
+
 char *
 sbrk(int n) {
+  if(pastulib(n))
+    return SBRK_ERROR;
   return sys_sbrk(n, SBRK_EAGER);
 }
 
 char *
 sbrklazy(int n) {
+  if(pastulib(n))
+    return SBRK_ERROR;
   return sys_sbrk(n, SBRK_LAZY);
 }
 
+//
+// getpid(), uptime() and the monotonic clock, read from the
+// kernel-maintained USYSPAGE instead of trapping. A kernel that
+// doesn't map the page gets the real system calls.
+//
+
+static struct usyspage *
+usyspage(void)
+{
+  static int mapped = -1;   // unknown until the first call
+  uint64 f;
+
+  if(mapped < 0){
+    // pteflags() returns -1, all bits set, for an unmapped page.
+    f = pteflags((void *) USYSPAGE);
+    mapped = (long) f != -1 && (f & (PTE_V | PTE_U)) == (PTE_V | PTE_U);
+  }
+  return mapped ? (struct usyspage *) USYSPAGE : 0;
+}
+
+int
+ugetpid(void)
+{
+  struct usyspage *u = usyspage();
+  return u ? u->pid : getpid();
+}
+
+int
+uuptime(void)
+{
+  struct usyspage *u = usyspage();
+  return u ? u->ticks : uptime();
+}
+
+uint64
+nsecs(void)
+{
+  struct usyspage *u = usyspage();
+  uint64 t, ns;
+
+  if(u == 0 || u->timefreq == 0){
+    // no page, or the kernel doesn't let us read the time CSR.
+    if(clock_gettime(CLOCK_MONOTONIC, &ns) < 0)
+      return 0;
+    return ns;
+  }
+  t = r_time() - u->timebase;
+  return (t / u->timefreq) * 1000000000 + (t % u->timefreq) * 1000000000 / u->timefreq;
+}
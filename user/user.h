@@ -1,5 +1,144 @@
 #define SBRK_ERROR ((char *)-1)
 
+// mprotect() protections
+#ifndef PROT_NONE
+#define PROT_NONE  0x0
+#define PROT_READ  0x1
+#define PROT_WRITE 0x2
+#define PROT_EXEC  0x4
+#endif
+
+// clock_gettime() clock ids
+#define CLOCK_MONOTONIC 0  // nanoseconds since boot, from the time CSR
+#define CLOCK_CYCLES    1  // cycles this process has run in user+kernel
+#define CLOCK_INSTRET   2  // instructions this process has retired
+
+// Read-only page the kernel maps into every process below the
+// trapframe, so that getpid/uptime/time need not trap. The two
+// pages in between stay unmapped; usertests uses them as bad
+// addresses. ulib checks that the page is mapped before using it.
+#define USYSPAGE 0x3fffffb000L   // MAXVA - 5*PGSIZE
+struct usyspage {
+  int pid;          // this process's pid
+  uint ticks;       // kernel ticks, as returned by uptime()
+  uint64 timefreq;  // time CSR frequency in Hz; 0 if user can't read time
+  uint64 timebase;  // time CSR value at boot
+};
+
+// kprof() commands
+#define KPROF_START 1   // clear the sample buffers and start sampling
+#define KPROF_STOP  2   // stop sampling; returns # of dropped samples
+#define KPROF_READ  3   // drain up to n samples into buf
+
+// one timer-interrupt sample
+struct kprofsample {
+  uint64 pc;        // interrupted sepc
+  int pid;          // 0 if the hart was idle in the scheduler
+  uchar cpu;
+  uchar user;       // 1 if the interrupt came from user mode
+};
+
+// ktrace(mask) records the event classes in mask into a fixed-size
+// ring per CPU; a record that finds its ring full is dropped. ktrace(0)
+// stops tracing and returns the number of records dropped since it
+// was started. ktraceread() drains up to n records: it returns 0 while
+// tracing is on and nothing is pending, and -1 once tracing is off
+// and every ring is empty.
+
+// ktrace() event class mask bits
+#define TR_SYSCALL  (1 << 0)   // syscall entry and exit
+#define TR_FAULT    (1 << 1)   // lazy, COW and protection page faults
+#define TR_SWITCH   (1 << 2)   // context switches
+#define TR_BIO      (1 << 3)   // block I/O submit and complete
+#define TR_LOG      (1 << 4)   // log commits
+
+// tracerec types
+#define TE_SYSENTER   1   // a0 = syscall number
+#define TE_SYSEXIT    2   // a0 = syscall number, a1 = return value
+#define TE_FAULTLAZY  3   // a0 = va, a1 = scause
+#define TE_FAULTCOW   4   // a0 = va, a1 = scause
+#define TE_FAULTPROT  5   // a0 = va, a1 = scause
+#define TE_SWITCH     6   // a0 = pid switched to, 0 for the scheduler
+#define TE_BIOSUBMIT  7   // a0 = blockno, a1 = 1 if write
+#define TE_BIODONE    8   // a0 = blockno, a1 = 1 if write
+#define TE_LOGCOMMIT  9   // a0 = # of blocks committed
+
+// fixed-size trace record
+struct tracerec {
+  uint64 time;      // ns since boot
+  ushort type;      // TE_*
+  uchar cpu;
+  uchar pad;
+  int pid;
+  uint64 a0;
+  uint64 a1;
+};
+
+// lockstat() commands
+#define LOCKSTAT_RESET 1   // zero every lock's counters
+#define LOCKSTAT_READ  2   // copy out up to n locks' counters
+
+// per-lock contention counters, for spinlocks and sleeplocks
+struct lockstat {
+  char name[16];    // as given to initlock or initsleeplock
+  uint64 acquires;  // calls to acquire or acquiresleep
+  uint64 contended; // acquires that found the lock held
+  uint64 spins;     // cycles spent spinning while it was held
+  uint64 sleeps;    // contended acquiresleeps that gave up spinning and slept
+};
+
+// sysstat() commands
+#define SYSSTAT_RESET 1   // zero every syscall's counters
+#define SYSSTAT_READ  2   // copy out counters for syscalls 0..n-1
+
+#define NSYSHIST 32       // log2 latency buckets
+
+// per-syscall counters, summed over all CPUs
+struct sysstat {
+  uint64 count;           // completed calls
+  uint64 ns;              // total time in the kernel
+  uint64 hist[NSYSHIST];  // hist[i]: calls taking [2^i, 2^(i+1)) ns
+};
+
+// one traced system call, as returned by straceread(). An exiting
+// traced process hands its unread records to its parent only if the
+// parent is traced; otherwise they stay with the zombie until it is
+// reaped, so straceread(pid) can drain them after pid exits.
+struct straced {
+  int pid;
+  int num;          // SYS_* number
+  uint64 arg[3];    // first three arguments
+  uint64 ret;
+  uint64 ns;        // time spent in the kernel
+};
+
+// one page as reported by pagemap()
+struct pagemapent {
+  uint64 pa;        // physical address, or -1 if unmapped
+  uint64 flags;     // PTE flags, 0 if unmapped
+  int level;        // page-table level of the leaf: 0 = 4K, 1 = 2M, 2 = 1G
+};
+
+#define NWSAGE 16         // idle-age buckets
+
+// working-set estimate for one process, from periodic PTE_A scans
+struct wsstat {
+  uint64 scans;           // scans of this process so far
+  uint64 age[NWSAGE];     // age[i]: resident pages idle for i scans;
+                          // the last bucket also counts older pages
+};
+
+// getrlimit()/setrlimit() resources, all counted in pages.
+// Limits are inherited across fork; a process may only lower its
+// own. The TREE limits cap the sum over a process and all of its
+// descendants.
+#define RLIMIT_RSS      0   // resident user pages
+#define RLIMIT_AS       1   // address space, including lazy sbrk
+#define RLIMIT_TREERSS  2
+#define RLIMIT_TREEAS   3
+#define RLIM_NLIMITS    4
+#define RLIM_INFINITY   (~0UL)
+
 struct stat;
 
 // system calls
@@ -28,6 +167,23 @@ int freepages(void);
 uint64 pteflags(void *va);
 uint64 ptepa(void *va);
 int mprotect(void *addr, uint64 len, int prot);
+int clock_gettime(int clk, uint64 *val);
+int kprof(int cmd, struct kprofsample *buf, int n);
+int ktrace(uint mask);
+int ktraceread(struct tracerec *buf, int n);
+int lockstat(int cmd, struct lockstat *buf, int n);
+int sysstat(int cmd, struct sysstat *buf, int n);
+int trace(uint64 mask);
+int straceread(int pid, struct straced *buf, int n);
+int dirtypages(void *addr, int npages, uchar *bits, int clear);
+int pagemap(void *addr, int npages, struct pagemapent *out);
+int wsstat(int pid, struct wsstat *ws);
+int snapshot(void);
+int restore(void);
+int oomadj(int adj);
+int getrlimit(int resource, uint64 *limit);
+int setrlimit(int resource, uint64 limit);
+int freeorders(uint64 *nfree, int n);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -43,6 +199,13 @@ int memcmp(const void *, const void *, uint);
 void *memcpy(void *, const void *, uint);
 char* sbrk(int);
 char* sbrklazy(int);
+uint64 nsecs(void);
+int ugetpid(void);
+int uuptime(void);
+
+// sysnames.c, generated by usys.pl -n; linked only where needed
+extern char *sysnames[];
+extern int nsysnames;
 
 // printf.c
 void fprintf(int, const char*, ...) __attribute__ ((format (printf, 2, 3)));
@@ -241,6 +241,106 @@ copyinstr3(char *s)
   }
 }
 
+// copyout into a COW-shared page must break the sharing
+// rather than write through to the parent's page, and copyin
+// from it must see the shared contents.
+void
+copycow(char *s)
+{
+  char *p = sbrk(PGSIZE);
+  int fds[2], pid, xstatus;
+
+  if(p == SBRK_ERROR){
+    printf("%s: sbrk failed\n", s);
+    exit(1);
+  }
+  memset(p, 'P', PGSIZE);
+
+  pid = fork();
+  if(pid < 0){
+    printf("%s: fork failed\n", s);
+    exit(1);
+  }
+  if(pid == 0){
+    char buf[64];
+
+    if(pipe(fds) < 0)
+      exit(1);
+    // copyin from the shared page sees the parent's bytes.
+    if(write(fds[1], p, 64) != 64 || read(fds[0], buf, 64) != 64 ||
+       buf[0] != 'P' || buf[63] != 'P')
+      exit(1);
+    // copyout of different bytes into the shared page lands in
+    // the child's own copy, and only where it was aimed.
+    memset(buf, 'c', sizeof(buf));
+    if(write(fds[1], buf, 64) != 64 || read(fds[0], p + 1, 64) != 64)
+      exit(1);
+    if(p[0] != 'P' || p[1] != 'c' || p[64] != 'c' || p[65] != 'P')
+      exit(1);
+    exit(0);
+  }
+  wait(&xstatus);
+  if(xstatus != 0){
+    printf("%s: child copyin/copyout on COW page failed\n", s);
+    exit(1);
+  }
+  for(int i = 0; i < PGSIZE; i++){
+    if(p[i] != 'P'){
+      printf("%s: child's copyout changed parent's page at %d\n", s, i);
+      exit(1);
+    }
+  }
+}
+
+// copyin and copyout must honor mprotect: fail with -1 (or,
+// for a pipe, copy nothing), not kill the process and not
+// bypass the protection.
+void
+copyprot(char *s)
+{
+  char *p = sbrk(2*PGSIZE);
+  int fds[2], n;
+
+  if(p == SBRK_ERROR){
+    printf("%s: sbrk failed\n", s);
+    exit(1);
+  }
+  p = (char *) PGROUNDUP((uint64) p);
+  memset(p, 'A', PGSIZE);
+  if(pipe(fds) < 0){
+    printf("%s: pipe failed\n", s);
+    exit(1);
+  }
+
+  if(mprotect(p, PGSIZE, PROT_READ) < 0){
+    printf("%s: mprotect failed\n", s);
+    exit(1);
+  }
+  if(write(fds[1], p, 8) != 8){
+    printf("%s: copyin from PROT_READ page failed\n", s);
+    exit(1);
+  }
+  n = read(fds[0], p, 8);
+  if(n > 0 || p[0] != 'A'){
+    printf("%s: read(pipe) into PROT_READ page returned %d, not -1 or 0\n", s, n);
+    exit(1);
+  }
+
+  if(mprotect(p, PGSIZE, PROT_NONE) < 0){
+    printf("%s: mprotect failed\n", s);
+    exit(1);
+  }
+  n = write(fds[1], p, 8);
+  if(n > 0){
+    printf("%s: write(pipe) from PROT_NONE page returned %d, not -1 or 0\n", s, n);
+    exit(1);
+  }
+
+  mprotect(p, PGSIZE, PROT_READ | PROT_WRITE);
+  close(fds[0]);
+  close(fds[1]);
+}
+
 // See if the kernel refuses to read/write user memory that the
 // application doesn't have anymore, because it returned it.
 void
@@ -2403,7 +2503,9 @@ void argptest(char *s)
 }
 
 // check that there's an invalid page beneath
-// the user stack, to catch stack overflow.
+// the user stack, to catch stack overflow. A kernel that
+// defines USTACKMAX in param.h reserves that many stack pages,
+// growing them on fault, and puts the guard page below them.
 void
 stacktest(char *s)
 {
@@ -2413,7 +2515,11 @@ stacktest(char *s)
   pid = fork();
   if(pid == 0) {
     char *sp = (char *) r_sp();
+#ifdef USTACKMAX
+    sp = (char *) PGROUNDUP((uint64) sp) - USTACKMAX*PGSIZE - 1;
+#else
     sp -= USERSTACK*PGSIZE;
+#endif
     // the *sp should cause a trap.
     printf("%s: stacktest: read below stack %d\n", s, *sp);
     exit(1);
@@ -2428,6 +2534,44 @@ stacktest(char *s)
     exit(xstatus);
 }
 
+#ifdef USTACKMAX
+// recurse through pagesdeep stack pages, touching each.
+static int
+stackdown(int pagesdeep)
+{
+  volatile char frame[PGSIZE - 128];
+
+  frame[0] = 1;
+  if(pagesdeep > 1)
+    return stackdown(pagesdeep - 1) + frame[0];
+  return frame[0];
+}
+
+// the stack starts at USERSTACK pages and grows on fault, one
+// page at a time, as deep recursion walks below it.
+void
+stackgrow(char *s)
+{
+  char *sp = (char *) r_sp();
+  int free0, free1, deep = USTACKMAX / 2;
+
+  if((long) pteflags((void *) PGROUNDDOWN((uint64) sp - USERSTACK*PGSIZE - PGSIZE)) != -1){
+    printf("%s: stack below the first pages mapped before use\n", s);
+    exit(1);
+  }
+  free0 = freepages();
+  if(stackdown(deep) != deep){
+    printf("%s: recursion computed the wrong value\n", s);
+    exit(1);
+  }
+  free1 = freepages();
+  if(free0 - free1 < deep - USERSTACK || free0 - free1 > deep + 8){
+    printf("%s: %d pages of recursion used %d pages\n", s, deep, free0 - free1);
+    exit(1);
+  }
+}
+#endif
+
 // check that writes to a few forbidden addresses
 // cause a fault, e.g. process's text and TRAMPOLINE.
 void
@@ -2698,6 +2842,471 @@ lazy_copy(char *s)
   exit(0);
 }
 
+// check that clock_gettime() has sub-tick resolution, agrees
+// with uptime(), and counts this process's cycles.
+void
+clocktest(char *s)
+{
+  uint64 t0, t1, c0, c1, i0, i1;
+  int u0, u1;
+
+  if(clock_gettime(CLOCK_MONOTONIC, &t0) < 0 ||
+     clock_gettime(CLOCK_MONOTONIC, &t1) < 0){
+    printf("%s: clock_gettime failed\n", s);
+    exit(1);
+  }
+  if(t1 < t0){
+    printf("%s: clock went backwards %ld %ld\n", s, t0, t1);
+    exit(1);
+  }
+
+  // two back-to-back reads must be far closer than one tick.
+  if(t1 - t0 >= 1000000){
+    printf("%s: back-to-back reads %ld ns apart\n", s, t1 - t0);
+    exit(1);
+  }
+
+  u0 = uptime();
+  t0 = nsecs();
+  pause(2);
+  t1 = nsecs();
+  u1 = uptime();
+  if(u1 - u0 < 1 || t1 - t0 < 1000000){
+    printf("%s: pause(2) took %d ticks, %ld ns\n", s, u1 - u0, t1 - t0);
+    exit(1);
+  }
+
+  if(clock_gettime(CLOCK_CYCLES, &c0) < 0 || clock_gettime(CLOCK_INSTRET, &i0) < 0){
+    printf("%s: per-process counters failed\n", s);
+    exit(1);
+  }
+  for(volatile int i = 0; i < 100000; i++)
+    ;
+  clock_gettime(CLOCK_CYCLES, &c1);
+  clock_gettime(CLOCK_INSTRET, &i1);
+  if(c1 <= c0 || i1 - i0 < 100000){
+    printf("%s: counters did not advance: cycles %ld instret %ld\n", s, c1 - c0, i1 - i0);
+    exit(1);
+  }
+
+  if(clock_gettime(-1, &t0) != -1 || clock_gettime(CLOCK_MONOTONIC, (uint64*)0x4000000000) != -1){
+    printf("%s: clock_gettime accepted bad arguments\n", s);
+    exit(1);
+  }
+}
+
+// check that the USYSPAGE is mapped read-only and agrees with the
+// real system calls, in the parent and in a forked child.
+void
+usyscall(char *s)
+{
+  int pid, xstatus;
+  uint64 t0, t1, flags;
+
+  flags = pteflags((void *) USYSPAGE);
+  if((long) flags == -1 ||
+     (flags & (PTE_V | PTE_U | PTE_R)) != (PTE_V | PTE_U | PTE_R) || (flags & PTE_W)){
+    printf("%s: USYSPAGE flags %lx\n", s, flags);
+    exit(1);
+  }
+
+  if(ugetpid() != getpid()){
+    printf("%s: ugetpid %d != getpid %d\n", s, ugetpid(), getpid());
+    exit(1);
+  }
+  if(uuptime() > uptime() || uptime() - uuptime() > 1){
+    printf("%s: uuptime %d, uptime %d\n", s, uuptime(), uptime());
+    exit(1);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  t1 = nsecs();
+  if(t1 < t0){
+    printf("%s: nsecs %ld behind clock_gettime %ld\n", s, t1, t0);
+    exit(1);
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf("%s: fork failed\n", s);
+    exit(1);
+  }
+  if(pid == 0){
+    if(ugetpid() != getpid())
+      exit(1);
+    // the page must not be writable.
+    ((struct usyspage *)USYSPAGE)->pid = 0;
+    exit(1);
+  }
+  wait(&xstatus);
+  if(xstatus != -1){
+    printf("%s: child could write USYSPAGE\n", s);
+    exit(1);
+  }
+}
+
+// exec maps text read-only from a page cache keyed by (inode,
+// offset), so a freshly exec'd usertests must share this one's
+// text page. The child reports its PA via "usertests -textpa fd",
+// handled in main().
+void
+sharedtext(char *s)
+{
+  int fds[2], pid, xstatus;
+  uint64 pa, flags, childpa = 0;
+  char fdstr[4];
+  char *argv[] = { "usertests", "-textpa", fdstr, 0 };
+
+  pa = ptepa((void *) PGROUNDDOWN((uint64) sharedtext));
+  flags = pteflags((void *) PGROUNDDOWN((uint64) sharedtext));
+  if(flags & PTE_W){
+    printf("%s: text page is writable\n", s);
+    exit(1);
+  }
+
+  if(pipe(fds) < 0){
+    printf("%s: pipe failed\n", s);
+    exit(1);
+  }
+  fdstr[0] = '0' + fds[1];
+  fdstr[1] = 0;
+  pid = fork();
+  if(pid < 0){
+    printf("%s: fork failed\n", s);
+    exit(1);
+  }
+  if(pid == 0){
+    exec("usertests", argv);
+    printf("%s: exec failed\n", s);
+    exit(1);
+  }
+  close(fds[1]);
+  if(read(fds[0], &childpa, sizeof(childpa)) != sizeof(childpa)){
+    printf("%s: no pa from child\n", s);
+    exit(1);
+  }
+  close(fds[0]);
+  wait(&xstatus);
+  if(childpa != pa){
+    printf("%s: text pa %p, exec'd copy has %p\n", s, (void *) pa, (void *) childpa);
+    exit(1);
+  }
+}
+
+// a big process's pages may be freed in the background after
+// it exits, but freepages() must get back to where it was.
+void
+exitfree(char *s)
+{
+  int free0, free1, pid, xstatus;
+
+  free0 = freepages();
+  pid = fork();
+  if(pid < 0){
+    printf("%s: fork failed\n", s);
+    exit(1);
+  }
+  if(pid == 0){
+    char *p = sbrk(8 << 20);
+    if(p == SBRK_ERROR)
+      exit(1);
+    for(int i = 0; i < (8 << 20); i += PGSIZE)
+      p[i] = 1;
+    exit(0);
+  }
+  wait(&xstatus);
+  if(xstatus != 0){
+    printf("%s: child sbrk failed\n", s);
+    exit(1);
+  }
+  for(int i = 0; i < 50; i++){
+    if((free1 = freepages()) >= free0)
+      return;
+    pause(1);
+  }
+  printf("%s: freepages %d after exit, %d before fork\n", s, free1, free0);
+  exit(1);
+}
+
+// dirtypages() reports pages written since the last clearing
+// call, one bit per page; reads must not count, and clearing must
+// not lose data or write access.
+void
+dirtytrack(char *s)
+{
+  int npages = 16;
+  char *p = sbrk((npages+1)*PGSIZE);
+  uchar bits[2];
+  int n;
+
+  if(p == SBRK_ERROR){
+    printf("%s: sbrk failed\n", s);
+    exit(1);
+  }
+  p = (char *) PGROUNDUP((uint64) p);
+  for(int i = 0; i < npages; i++)
+    p[i*PGSIZE] = i;
+  n = dirtypages(p, npages, bits, 1);
+  if(n != npages || bits[0] != 0xff || bits[1] != 0xff){
+    printf("%s: after first touch %d dirty, bits %x %x\n", s, n, bits[0], bits[1]);
+    exit(1);
+  }
+
+  for(int i = 0; i < npages; i++){
+    if(p[i*PGSIZE] != i){
+      printf("%s: clearing dirty state lost data\n", s);
+      exit(1);
+    }
+  }
+  p[2*PGSIZE + 7] = 'x';
+  p[11*PGSIZE] = 'y';
+  n = dirtypages(p, npages, bits, 0);
+  if(n != 2 || bits[0] != (1 << 2) || bits[1] != (1 << 3)){
+    printf("%s: expected pages 2 and 11, got %d dirty, bits %x %x\n", s, n, bits[0], bits[1]);
+    exit(1);
+  }
+  // without clear, the state is unchanged.
+  if(dirtypages(p, npages, bits, 1) != 2 || dirtypages(p, npages, bits, 0) != 0){
+    printf("%s: clear flag not honored\n", s);
+    exit(1);
+  }
+
+  if(dirtypages((void *) 0x4000000000, 1, bits, 0) != -1){
+    printf("%s: dirtypages accepted an address above MAXVA\n", s);
+    exit(1);
+  }
+}
+
+// snapshot() COW-shares the address space and registers with a
+// saved image and returns 0; restore() throws away every page
+// dirtied since, resets sbrk, and returns from snapshot() again,
+// this time with 1. File descriptors are not part of the image,
+// so a pipe counts the rounds.
+int snapglobal = 1;
+
+void
+snaprestore(char *s)
+{
+  char *heap = sbrk(PGSIZE);
+  char *end0, *p, c;
+  int fds[2], r;
+
+  if(heap == SBRK_ERROR){
+    printf("%s: sbrk failed\n", s);
+    exit(1);
+  }
+  heap[0] = 'S';
+  end0 = sbrk(0);
+  if(pipe(fds) < 0){
+    printf("%s: pipe failed\n", s);
+    exit(1);
+  }
+  write(fds[1], "abc", 3);
+  close(fds[1]);
+
+  r = snapshot();
+  if(r < 0){
+    printf("%s: snapshot failed\n", s);
+    exit(1);
+  }
+  if(heap[0] != 'S' || snapglobal != 1 || sbrk(0) != end0){
+    printf("%s: restore did not reset memory (round %d)\n", s, r);
+    exit(1);
+  }
+  if(read(fds[0], &c, 1) == 1){
+    heap[0] = c;
+    snapglobal = 2;
+    if((p = sbrk(4*PGSIZE)) != SBRK_ERROR)
+      p[0] = c;
+    restore();
+    printf("%s: restore returned\n", s);
+    exit(1);
+  }
+  if(r != 1){
+    printf("%s: snapshot returned %d after a restore\n", s, r);
+    exit(1);
+  }
+  close(fds[0]);
+}
+
+// when a lazy or COW fault finds no free memory, the kernel
+// should kill the process with the largest resident size (scaled
+// by oomadj) and retry the fault, rather than kill the small
+// process that happened to fault.
+void
+oomkill(char *s)
+{
+  int fds[2], pid, xstatus;
+  char *lazy, c;
+
+  oomadj(-1000);
+  lazy = sbrklazy(64*PGSIZE);
+  if(lazy == SBRK_ERROR || pipe(fds) < 0){
+    printf("%s: setup failed\n", s);
+    exit(1);
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf("%s: fork failed\n", s);
+    exit(1);
+  }
+  if(pid == 0){
+    // take every free page, then wait to be killed.
+    oomadj(0);
+    while(sbrk(PGSIZE) != SBRK_ERROR)
+      ;
+    write(fds[1], "x", 1);
+    pause(100);
+    exit(0);
+  }
+  close(fds[1]);
+  if(read(fds[0], &c, 1) != 1){
+    printf("%s: hog died before filling memory\n", s);
+    exit(1);
+  }
+  close(fds[0]);
+
+  // each of these faults needs a page that isn't there.
+  for(int i = 0; i < 64; i++)
+    lazy[i*PGSIZE] = i;
+  for(int i = 0; i < 64; i++){
+    if(lazy[i*PGSIZE] != i){
+      printf("%s: lost data in lazy page %d\n", s, i);
+      exit(1);
+    }
+  }
+
+  if(wait(&xstatus) != pid || xstatus != -1){
+    printf("%s: hog was not the OOM victim\n", s);
+    exit(1);
+  }
+}
+
+// RLIMIT_AS must stop sbrk, eager or lazy, and RLIMIT_RSS must
+// stop lazy faults from growing a process past its limit; both
+// must be inherited across fork.
+void
+rlimittest(char *s)
+{
+  uint64 cur = PGROUNDUP((uint64) sbrk(0)) / PGSIZE, lim;
+  int pid, xstatus;
+
+  if(getrlimit(RLIMIT_AS, &lim) < 0 || lim != RLIM_INFINITY){
+    printf("%s: RLIMIT_AS should start unlimited\n", s);
+    exit(1);
+  }
+
+  if(setrlimit(RLIMIT_AS, cur + 128) < 0){
+    printf("%s: setrlimit failed\n", s);
+    exit(1);
+  }
+  if(sbrk(256*PGSIZE) != SBRK_ERROR || sbrklazy(256*PGSIZE) != SBRK_ERROR){
+    printf("%s: sbrk grew past RLIMIT_AS\n", s);
+    exit(1);
+  }
+  if(sbrk(8*PGSIZE) == SBRK_ERROR){
+    printf("%s: sbrk within RLIMIT_AS failed\n", s);
+    exit(1);
+  }
+  if(setrlimit(RLIMIT_AS, RLIM_INFINITY) != -1){
+    printf("%s: raised a limit\n", s);
+    exit(1);
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf("%s: fork failed\n", s);
+    exit(1);
+  }
+  if(pid == 0){
+    if(getrlimit(RLIMIT_AS, &lim) < 0 || lim != cur + 128)
+      exit(1);
+    // give the child its own RSS limit, with room for lazy sbrk.
+    char *p = sbrk(0);
+    if(setrlimit(RLIMIT_RSS, PGROUNDUP((uint64) p) / PGSIZE + 4) < 0)
+      exit(1);
+    if(sbrklazy(64*PGSIZE) == SBRK_ERROR)
+      exit(1);
+    for(int i = 0; i < 64; i++)
+      p[i*PGSIZE] = 1;
+    // a fault past the limit should have killed us.
+    exit(0);
+  }
+  wait(&xstatus);
+  if(xstatus != -1){
+    printf("%s: child exceeded RLIMIT_RSS (status %d)\n", s, xstatus);
+    exit(1);
+  }
+}
+
+// freeorders() reports the buddy allocator's free blocks by
+// order; they must add up to freepages(). Other processes may
+// allocate between the two calls, so retry until freepages()
+// reads the same before and after freeorders().
+void
+buddyfree(char *s)
+{
+  uint64 nfree[32], total;
+  int n, free0, free1;
+
+  for(int try = 0; try < 10; try++){
+    free0 = freepages();
+    n = freeorders(nfree, 32);
+    free1 = freepages();
+    if(n <= 0 || n > 32){
+      printf("%s: freeorders returned %d\n", s, n);
+      exit(1);
+    }
+    total = 0;
+    for(int k = 0; k < n; k++)
+      total += nfree[k] << k;
+    if(total == free0 && free0 == free1)
+      return;
+  }
+  printf("%s: orders sum to %ld pages, freepages says %d then %d\n", s, total, free0, free1);
+  exit(1);
+}
+
+// one pagemap() call over a range must agree with a ptepa() and
+// pteflags() call per page, for mapped pages and for the unmapped
+// page past the heap.
+void
+pagemaptest(char *s)
+{
+  const uint64 m = PTE_V | PTE_R | PTE_W | PTE_X | PTE_U;
+  struct pagemapent e[8];
+  char *top, *base;
+  int n;
+
+  // seven eager pages starting page-aligned, then nothing.
+  top = sbrk(0);
+  base = (char *) PGROUNDUP((uint64) top);
+  if(sbrk(base - top + 7*PGSIZE) == SBRK_ERROR){
+    printf("%s: sbrk failed\n", s);
+    exit(1);
+  }
+  for(int i = 0; i < 7; i++)
+    base[i*PGSIZE] = i;
+
+  n = pagemap(base, 8, e);
+  if(n != 8){
+    printf("%s: pagemap returned %d\n", s, n);
+    exit(1);
+  }
+  for(int i = 0; i < 7; i++){
+    char *va = base + i*PGSIZE;
+    if(e[i].pa != ptepa(va) || (e[i].flags & m) != (pteflags(va) & m)){
+      printf("%s: page %d: pagemap pa %p flags %lx, pte pa %p flags %lx\n",
+             s, i, (void *) e[i].pa, e[i].flags, (void *) ptepa(va), pteflags(va));
+      exit(1);
+    }
+  }
+  if(e[7].pa != (uint64) -1 || e[7].flags != 0){
+    printf("%s: page past the heap reported as mapped\n", s);
+    exit(1);
+  }
+}
+
 struct test {
   void (*f)(char *);
   char *s;
@@ -2707,6 +3316,7 @@ struct test {
   {copyinstr1, "copyinstr1"},
   {copyinstr2, "copyinstr2"},
   {copyinstr3, "copyinstr3"},
+  {copycow, "copycow"},
   {rwsbrk, "rwsbrk" },
   {truncate1, "truncate1"},
   {truncate2, "truncate2"},
@@ -2765,6 +3375,7 @@ struct test {
   {lazy_alloc, "lazy_alloc"},
   {lazy_unmap, "lazy_unmap"},
   {lazy_copy, "lazy_copy"},
+  {exitfree, "exitfree"},
   { 0, 0},
 };
 
@@ -3064,6 +3675,29 @@ struct test slowtests[] = {
   { 0, 0},
 };
 
+//
+// Section with tests of kernel features that the kernel may not
+// implement yet.  They are not run by default; name one to run it,
+// e.g. "usertests clocktest".
+//
+
+struct test featuretests[] = {
+  {clocktest, "clocktest"},
+  {usyscall, "usyscall"},
+  {sharedtext, "sharedtext"},
+#ifdef USTACKMAX
+  {stackgrow, "stackgrow"},
+#endif
+  {dirtytrack, "dirtytrack"},
+  {snaprestore, "snaprestore"},
+  {oomkill, "oomkill"},
+  {rlimittest, "rlimit"},
+  {buddyfree, "buddyfree"},
+  {pagemaptest, "pagemap"},
+  {copyprot, "copyprot"},
+  { 0, 0},
+};
+
 //
 // drive tests
 //
@@ -3156,7 +3790,21 @@ drivetests(int quick, int continuous, char *justone) {
         ntests += n;
       }
     }
-    if((free1 = countfree()) < free0) {
+    if(justone != 0) {
+      n = runtests(featuretests, justone, continuous);
+      if (n < 0) {
+        if(continuous != 2) {
+          return 1;
+        }
+      } else {
+        ntests += n;
+      }
+    }
+    // pages of exited test processes may still be on their way
+    // back from the background reclaimer; give it a few ticks.
+    for(int i = 0; i < 50 && (free1 = countfree()) < free0; i++)
+      pause(1);
+    if(free1 < free0) {
       printf("FAILED -- lost some free pages %d (out of %d)\n", free1, free0);
       if(continuous != 2) {
         return 1;
@@ -3183,6 +3831,11 @@ main(int argc, char *argv[])
     continuous = 1;
   } else if(argc == 2 && strcmp(argv[1], "-C") == 0){
     continuous = 2;
+  } else if(argc == 3 && strcmp(argv[1], "-textpa") == 0){
+    // for sharedtext: report where our text lives.
+    uint64 pa = ptepa((void *) PGROUNDDOWN((uint64) sharedtext));
+    write(atoi(argv[2]), &pa, sizeof(pa));
+    exit(0);
   } else if(argc == 2 && argv[1][0] != '-'){
     justone = argv[1];
   } else if(argc > 1){
@@ -1,14 +1,31 @@
 #!/usr/bin/perl -w
 
 # Generate usys.S, the stubs for syscalls.
+# With -n, generate sysnames.c, the syscall names indexed by number.
 
-print "# generated by usys.pl - do not edit\n";
+my $names = @ARGV && $ARGV[0] eq "-n";
 
-print "#include \"kernel/syscall.h\"\n";
+if ($names) {
+    print "// generated by usys.pl -n - do not edit\n";
+    print "#include \"kernel/syscall.h\"\n";
+    print "\n";
+    print "char *sysnames[] = {\n";
+} else {
+    print "# generated by usys.pl - do not edit\n";
+    print "#include \"kernel/syscall.h\"\n";
+}
+
+sub name {
+    my $name = shift;
+    print "#ifdef SYS_${name}\n";
+    print "[SYS_${name}] \"$name\",\n";
+    print "#endif\n";
+}
 
 sub entry {
     my $prefix = "sys_";
     my $name = shift;
+    return name($name) if $names;
     if ($name eq "sbrk") {
 	print ".global $prefix$name\n";
 	print "$prefix$name:\n";
@@ -20,6 +37,23 @@ sub entry {
     print " ecall\n";
     print " ret\n";
 }
+
+# Like entry(), for system calls whose kernel side may not exist yet:
+# if kernel/syscall.h has no SYS_name, the stub returns -1 without
+# trapping, so the user tree still builds against that kernel.
+sub optentry {
+    my $name = shift;
+    return name($name) if $names;
+    print ".global $name\n";
+    print "$name:\n";
+    print "#ifdef SYS_${name}\n";
+    print " li a7, SYS_${name}\n";
+    print " ecall\n";
+    print "#else\n";
+    print " li a0, -1\n";
+    print "#endif\n";
+    print " ret\n";
+}
 	
 entry("fork");
 entry("exit");
@@ -46,3 +80,25 @@ entry("freepages");
 entry("pteflags");
 entry("ptepa");
 entry("mprotect");
+optentry("clock_gettime");
+optentry("kprof");
+optentry("ktrace");
+optentry("ktraceread");
+optentry("lockstat");
+optentry("sysstat");
+optentry("trace");
+optentry("straceread");
+optentry("dirtypages");
+optentry("pagemap");
+optentry("wsstat");
+optentry("snapshot");
+optentry("restore");
+optentry("oomadj");
+optentry("getrlimit");
+optentry("setrlimit");
+optentry("freeorders");
+
+if ($names) {
+    print "};\n";
+    print "int nsysnames = sizeof(sysnames)/sizeof(sysnames[0]);\n";
+}
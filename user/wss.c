@@ -0,0 +1,48 @@
+// Print the working-set estimate of each given process:
+//
+//   wss pid...
+//
+// The kernel scanner clears PTE_A on a process's user pages every
+// few ticks and ages the pages found unreferenced. wss prints the
+// idle-age histogram and the cumulative working set: pages touched
+// within the last 1, 2, 4 and 8 scans. Run the job in the
+// background ("grind &") and poll it with wss.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "user/user.h"
+
+void
+wss(int pid)
+{
+  struct wsstat ws;
+  uint64 total = 0, hot = 0;
+
+  if(wsstat(pid, &ws) < 0){
+    fprintf(2, "wss: no process %d\n", pid);
+    return;
+  }
+  for(int i = 0; i < NWSAGE; i++)
+    total += ws.age[i];
+
+  printf("pid %d: %ld resident pages, %ld scans\n", pid, total, ws.scans);
+  for(int i = 0; i < NWSAGE; i++){
+    hot += ws.age[i];
+    if(ws.age[i])
+      printf("  idle %d%s: %ld\n", i, i == NWSAGE-1 ? "+" : "", ws.age[i]);
+    if(i == 0 || i == 1 || i == 3 || i == 7)
+      printf("  wss(%d): %ld pages\n", i+1, hot);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc < 2){
+    fprintf(2, "usage: wss pid...\n");
+    exit(1);
+  }
+  for(int i = 1; i < argc; i++)
+    wss(atoi(argv[i]));
+  exit(0);
+}